@@ -8,7 +8,7 @@
 int main(void) {
 	void *ExecMem = VirtualAlloc(NULL, 4096, MEM_COMMIT | MEM_RESERVE, PAGE_EXECUTE_READWRITE);
 
-	SIR_Function Functions[4] = {0};
+	SIR_Function Functions[5] = {0};
 	long long (*SumMinus20)(long long, long long);
 	Functions[0].FunctionPointerToOverride = (void **)&SumMinus20;
 	Functions[0].ArgumentsCount = 2;
@@ -54,7 +54,24 @@ int main(void) {
 	};
 	Functions[3].OperationsCount = 4;
 
-	SIR_AMD64Compile(Functions, len(Functions), ExecMem, 4096, NULL, 0, NULL, AMD64_WIN);
+	long long (*SumMinus20Times10)(long long, long long, long long);
+	Functions[4].FunctionPointerToOverride = (void **)&SumMinus20Times10;
+	Functions[4].ArgumentsCount = 3;
+	Functions[4].ReturnCount = 1;
+	Functions[4].Operations = (SIR_Operation[]){
+		 (SIR_Operation){.Instruction = SIR_Call, .OperandW1 = 0, .OperandW2 = 0, .OperandW3 = 1},
+		 (SIR_Operation){.Instruction = SIR_Call, .OperandW1 = 1, .OperandW2 = 3, .OperandW3 = 2},
+		 (SIR_Operation){.Instruction = SIR_Ret, .OperandW1 = 4},
+	};
+	Functions[4].OperationsCount = 3;
+
+	SIR_InlinedCall Inlined[8];
+	SIR_InlineOptions Inline = {.MaxCalleeOperations = 8, .MaxCallerOperations = 256, .Report = Inlined, .ReportSize = len(Inlined)};
+	SIR_AMD64Compile(Functions, len(Functions), ExecMem, 4096, NULL, 0, NULL, AMD64_WIN, &Inline);
+	for (Size i = 0; i < Inline.ReportCount && i < Inline.ReportSize; i += 1) {
+		printf("Inlined function %td into function %td at operation %td\n", Inlined[i].CalleeFunction, Inlined[i].CallerFunction,
+				 Inlined[i].CallOperation);
+	}
 
 	long long o;
 	o = SumMinus20(30, 40);
@@ -77,5 +94,8 @@ int main(void) {
 	o = SModSMulSDiv10(124, 42, 3);
 	printf("SModSMulSDiv10(124, 42, 3) = %lld\n", o);
 
+	o = SumMinus20Times10(30, 40, 3);
+	printf("SumMinus20Times10(30, 40, 3) = %lld\n", o);
+
 	return 0;
 }
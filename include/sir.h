@@ -94,6 +94,8 @@ typedef struct SIR_Operation {
 	};
 } SIR_Operation;
 
+// SIR_Call: OperandW1 is the index of the callee in the compiled batch, OperandW2 and OperandW3 are the argument vars.
+// The callee may take at most two arguments and its single return value is the var defined by the call.
 typedef struct SIR_Function {
 	void **FunctionPointerToOverride;
 	SIR_Operation *Operations;
@@ -102,8 +104,32 @@ typedef struct SIR_Function {
 	Size ReturnCount;
 } SIR_Function;
 
+typedef struct SIR_InlinedCall {
+	Size CallerFunction;
+	Size CallOperation;
+	Size CalleeFunction;
+} SIR_InlinedCall;
+
+typedef struct SIR_InlineOptions {
+	// Callees with more operations than this (not counting the final SIR_Ret) are never inlined.
+	Size MaxCalleeOperations;
+	// Inlining stops once the caller would grow past this many operations.
+	Size MaxCallerOperations;
+	// Every inlined call is appended here while ReportCount < ReportSize. ReportCount keeps counting past ReportSize.
+	SIR_InlinedCall *Report;
+	Size ReportSize;
+	Size ReportCount;
+} SIR_InlineOptions;
+
+// Writes Functions[Caller] operations into OutputOperations with the calls to small leaf functions of the batch spliced in.
+// Returns the new operations count.
+Size SIR_InlineCalls(SIR_Function *Functions, Size FunctionsCount, Size Caller, SIR_Operation *OutputOperations, Size OutputOperationsSize,
+							SIR_InlineOptions *Options);
+
+// Inline may be NULL to compile the functions as they are.
 void SIR_AMD64Compile(SIR_Function *Functions, Size FunctionsCount, void *OutputExecutableMemory, Size OutputExecutableMemorySize,
-							 void *OutputReadOnlyMemory, Size OutputReadOnlyMemorySize, uint64_t *Constants, AMD64_CallingConventions Convention);
+							 void *OutputReadOnlyMemory, Size OutputReadOnlyMemorySize, uint64_t *Constants, AMD64_CallingConventions Convention,
+							 SIR_InlineOptions *Inline);
 
 #define SIR_H
 #endif
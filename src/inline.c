@@ -0,0 +1,119 @@
+#include <sir.h>
+
+#include <assert.h>
+
+typedef struct InlineContext {
+	uint16_t CallerVarsMap[65536];
+	uint16_t CalleeVarsMap[65536];
+} InlineContext;
+
+// Only straight line code can be renumbered, since the operands of the remaining instructions are not var references.
+static int SIR_IsStraightLine(SIR_Function *f, Size OperationsCount) {
+	for (Size op = 0; op < OperationsCount; op += 1) {
+		uint8_t Instruction = f->Operations[op].Instruction;
+		if (Instruction > SIR_Call && Instruction != SIR_Ret)
+			return 0;
+	}
+	return 1;
+}
+
+static void SIR_RemapOperation(SIR_Operation *o, uint16_t *Map, Size CallArguments) {
+	uint8_t OpType = o->InstructionOptions & SIR_OperandTypeMask;
+	if (o->Instruction == SIR_Call) {
+		if (CallArguments > 0)
+			o->OperandW2 = Map[o->OperandW2];
+		if (CallArguments > 1)
+			o->OperandW3 = Map[o->OperandW3];
+		return;
+	}
+
+	o->OperandW1 = Map[o->OperandW1];
+	if (o->Instruction != SIR_Ret && OpType == SIR_Var) {
+		o->OperandW2 = Map[o->OperandW2];
+	}
+}
+
+static int SIR_CanInline(SIR_Function *Callee, SIR_InlineOptions *Options) {
+	Size BodyCount = Callee->OperationsCount - 1;
+	if (Callee->ReturnCount != 1 || Callee->ArgumentsCount > 2)
+		return 0;
+	if (BodyCount < 0 || BodyCount > Options->MaxCalleeOperations)
+		return 0;
+	if (Callee->Operations[BodyCount].Instruction != SIR_Ret)
+		return 0;
+
+	// Leaf functions only, nested calls would need their own renumbering pass
+	for (Size op = 0; op < BodyCount; op += 1) {
+		if (Callee->Operations[op].Instruction >= SIR_Call)
+			return 0;
+	}
+	return 1;
+}
+
+Size SIR_InlineCalls(SIR_Function *Functions, Size FunctionsCount, Size Caller, SIR_Operation *OutputOperations, Size OutputOperationsSize,
+							SIR_InlineOptions *Options) {
+	_Thread_local static InlineContext ctx;
+	InlineContext *c = &ctx;
+	SIR_Function *f = &Functions[Caller];
+	assert(f->OperationsCount <= OutputOperationsSize);
+
+	Size Limit = OutputOperationsSize;
+	Limit = Options->MaxCallerOperations < Limit ? Options->MaxCallerOperations : Limit;
+	Limit = 65535 - f->ArgumentsCount < Limit ? 65535 - f->ArgumentsCount : Limit;
+	int CanRenumber = SIR_IsStraightLine(f, f->OperationsCount);
+
+	for (Size Var = 0; Var < f->ArgumentsCount; Var += 1) {
+		c->CallerVarsMap[Var] = (uint16_t)Var;
+	}
+
+	Size OutCount = 0;
+	for (Size op = 0; op < f->OperationsCount; op += 1) {
+		SIR_Operation *i = &f->Operations[op];
+		Size ThisVar = f->ArgumentsCount + op;
+		Size Remaining = f->OperationsCount - op - 1;
+
+		if (CanRenumber && i->Instruction == SIR_Call && i->OperandW1 < FunctionsCount && i->OperandW1 != Caller) {
+			Size CalleeIdx = i->OperandW1;
+			SIR_Function *Callee = &Functions[CalleeIdx];
+			Size BodyCount = Callee->OperationsCount - 1;
+
+			if (SIR_CanInline(Callee, Options) && OutCount + BodyCount + Remaining <= Limit) {
+				uint16_t ArgumentVars[2] = {i->OperandW2, i->OperandW3};
+				for (Size Var = 0; Var < Callee->ArgumentsCount; Var += 1) {
+					c->CalleeVarsMap[Var] = c->CallerVarsMap[ArgumentVars[Var]];
+				}
+
+				for (Size CalleeOp = 0; CalleeOp < BodyCount; CalleeOp += 1) {
+					SIR_Operation o = Callee->Operations[CalleeOp];
+					SIR_RemapOperation(&o, c->CalleeVarsMap, 0);
+					OutputOperations[OutCount] = o;
+					c->CalleeVarsMap[Callee->ArgumentsCount + CalleeOp] = (uint16_t)(f->ArgumentsCount + OutCount);
+					OutCount += 1;
+				}
+
+				// The call result is whatever the callee returned
+				c->CallerVarsMap[ThisVar] = c->CalleeVarsMap[Callee->Operations[BodyCount].OperandW1];
+
+				if (Options->ReportCount < Options->ReportSize) {
+					SIR_InlinedCall *Entry = &Options->Report[Options->ReportCount];
+					Entry->CallerFunction = Caller;
+					Entry->CallOperation = op;
+					Entry->CalleeFunction = CalleeIdx;
+				}
+				Options->ReportCount += 1;
+				continue;
+			}
+		}
+
+		SIR_Operation o = *i;
+		if (CanRenumber) {
+			Size CallArguments = (o.Instruction == SIR_Call && o.OperandW1 < FunctionsCount) ? Functions[o.OperandW1].ArgumentsCount : 0;
+			SIR_RemapOperation(&o, c->CallerVarsMap, CallArguments);
+			c->CallerVarsMap[ThisVar] = (uint16_t)(f->ArgumentsCount + OutCount);
+		}
+		OutputOperations[OutCount] = o;
+		OutCount += 1;
+	}
+
+	return OutCount;
+}
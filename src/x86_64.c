@@ -27,6 +27,7 @@ static const uint8_t RegistersEnconding[Regs_Count] = {
 	 [R9] = 0b001,	 [R10] = 0b010, [R11] = 0b011, [R12] = 0b100, [R13] = 0b101, [R14] = 0b110, [R15] = 0b111};
 
 typedef struct AMD64CompileContext {
+	SIR_Operation InlinedOperations[65535];
 	int16_t VarsLocation[65565];
 	int16_t MemFreeStack[4096];
 	uint8_t *restrict ExecutableMemory;
@@ -166,7 +167,8 @@ static Size SIR_AMD64GetVarIntoReg(AMD64CompileContext *c, Size Var, uint32_t Do
 }
 
 void SIR_AMD64Compile(SIR_Function *Functions, Size FunctionsCount, void *OutputExecutableMemory, Size OutputExecutableMemorySize,
-							 void *OutputReadOnlyMemory, Size OutputReadOnlyMemorySize, uint64_t *Constants, AMD64_CallingConventions Convention) {
+							 void *OutputReadOnlyMemory, Size OutputReadOnlyMemorySize, uint64_t *Constants, AMD64_CallingConventions Convention,
+							 SIR_InlineOptions *Inline) {
 	_Thread_local static AMD64CompileContext ctx;
 	AMD64CompileContext *c = &ctx;
 	c->ExecutableMemoryCursor = OutputExecutableMemorySize;
@@ -176,6 +178,13 @@ void SIR_AMD64Compile(SIR_Function *Functions, Size FunctionsCount, void *Output
 	// TODO: Optimize immediates that could be written in a single byte.
 	for (Size i = 0; i < FunctionsCount; i += 1) {
 		SIR_Function *f = &Functions[i];
+		SIR_Function Inlined;
+		if (Inline != NULL) {
+			Inlined = *f;
+			Inlined.Operations = c->InlinedOperations;
+			Inlined.OperationsCount = SIR_InlineCalls(Functions, FunctionsCount, i, c->InlinedOperations, 65535, Inline);
+			f = &Inlined;
+		}
 		memset(c->VarsLocation, 0, sizeof(c->VarsLocation[0] * (f->OperationsCount + f->ArgumentsCount)));
 		memset(c->MemFreeStack, 0, sizeof(c->MemFreeStack));
 		memset(c->CurrentRegsVar, 0, sizeof(c->CurrentRegsVar));
@@ -1 +1 @@
-cl /IInclude /Zi src\x86_64.c examples\win32_amd64.c /Fe:epic.exe
+cl /IInclude /Zi src\x86_64.c src\inline.c examples\win32_amd64.c /Fe:epic.exe